@@ -72,9 +72,36 @@ typedef enum {
   // A new burst will be ignored.
   RFIFO_DROP_NEW,
   // The oldest burst(s) will be dropped to release space for a new burst.
-  RFIFO_DROP_OLD
+  RFIFO_DROP_OLD,
+  // While the fifo is full, only every Nth new burst will be kept, with N
+  // set by radarSetFifoKeepEveryNth, 2 by default. The oldest burst is
+  // dropped to release space for a kept burst, the others are ignored.
+  RFIFO_KEEP_NTH,
+  // The oldest burst among those from the config slot(s) with the lowest
+  // priority, including the new burst, will be dropped. Priorities are set
+  // by radarSetSlotPriority and are 0 by default, so equal priorities
+  // behave like RFIFO_DROP_OLD.
+  RFIFO_SLOT_PRIORITY,
+  // The producer will wait until there is space for a new burst.
+  // Intended for replay drivers where no real-time data can be lost.
+  // Borrowed bursts do not take FIFO space, so holding them never blocks
+  // the producer.
+  // Drivers for live hardware return RC_UNSUPPORTED for this mode.
+  RFIFO_BLOCK_PRODUCER
 } RadarFifoMode;
 
+// Defines how a read waits for a burst that is not ready yet.
+typedef enum {
+  // A default undefined value that should be used at initialization.
+  RWAIT_UNDEFINED = 0,
+  // Block in the kernel until the burst is ready or the read times out.
+  RWAIT_BLOCK,
+  // Poll radarIsBurstReady for a bounded spin time, then block.
+  RWAIT_SPIN_THEN_BLOCK,
+  // Poll radarIsBurstReady until the burst is ready or the read times out.
+  RWAIT_BUSY_POLL
+} RadarWaitStrategy;
+
 //--------------------------------------
 //----- Params -------------------------
 //--------------------------------------
@@ -176,10 +203,126 @@ typedef struct RadarBurstFormat_s {
   };
   // CRC for the current burst data buffer.
   uint32_t burst_data_crc;
-  // Timestamp when the burst was created since radar was turned on.
+  // Timestamp when the burst was created since radar was first turned on.
+  // Keeps counting across radarRestart.
+  // Wraps after ~49 days, prefer RadarBurstFormatExt::sensor_timestamp_ns.
   uint32_t timestamp_ms;
 } RadarBurstFormat;
 
+// An extended data format of burst data, filled in by the read functions
+// added after radarReadBurst. radarReadBurst keeps writing only
+// RadarBurstFormat, so applications built against older headers stay safe.
+typedef struct RadarBurstFormatExt_s {
+  // Size of this struct in bytes, set by the caller before a read. The driver
+  // only writes fields that fit into it, so fields added later never overflow
+  // an older caller. RC_BAD_INPUT is returned if it cannot hold format.
+  uint32_t struct_size;
+  // The basic data format of the burst.
+  RadarBurstFormat format;
+  union {
+    struct {
+      // True/1 if the *_timestamp_ns fields below are filled in.
+      uint16_t has_extended_timestamps: 1;
+      // Reserved for future use.
+      uint16_t reserved: 15;
+    };
+    uint16_t flags;
+  };
+  // Timestamp in nanoseconds when the burst was created since radar was
+  // first turned on, in the sensor clock domain. Keeps counting across
+  // radarRestart and does not wrap in practice.
+  // Valid only if has_extended_timestamps is set.
+  uint64_t sensor_timestamp_ns;
+  // CLOCK_MONOTONIC time in nanoseconds when the host started receiving
+  // the burst. Valid only if has_extended_timestamps is set.
+  uint64_t host_receive_timestamp_ns;
+  // CLOCK_MONOTONIC time in nanoseconds when the burst transfer to the host
+  // completed. Valid only if has_extended_timestamps is set.
+  uint64_t transfer_complete_timestamp_ns;
+  // Generation of the config slot, incremented every time it is changed.
+  // Starts at 1, 0 if the driver does not track generations.
+  uint32_t config_generation;
+} RadarBurstFormatExt;
+
+// Identifies a burst borrowed with radarAcquireBurst. A new token is issued
+// for every borrow and never reused for the lifetime of the handle, 0 is
+// never a valid token.
+typedef uint64_t RadarBurstToken;
+
+// A burst borrowed from the driver's burst buffer pool.
+typedef struct RadarBorrowedBurst_s {
+  // Token to return the burst with radarReleaseBurst.
+  RadarBurstToken token;
+  // Burst data owned by the driver, valid until the burst is released.
+  const uint8_t* data;
+  // Size of the burst data in bytes.
+  uint32_t size;
+  // Data format of the burst. format.struct_size is set by the caller.
+  RadarBurstFormatExt format;
+} RadarBorrowedBurst;
+
+// Describes the memory layout of bursts generated by a config slot.
+// Stays the same for all bursts with matching config_id and
+// config_generation, so it can be computed once and cached.
+typedef struct RadarBurstLayout_s {
+  // Config slot ID the layout belongs to.
+  uint8_t config_id;
+  // Generation of the config slot the layout was computed for, 0 if the
+  // driver does not track generations. A layout with generation 0 must
+  // not be cached.
+  uint32_t config_generation;
+  // Amount of bits per single sample.
+  uint8_t bits_per_sample;
+  // Amount of samples per single chirp.
+  uint16_t samples_per_chirp;
+  // Amount of active channels in a burst.
+  uint8_t channels_count;
+  // Amount of chirps in a burst.
+  uint8_t chirps_per_burst;
+  // Distance in samples between two consecutive samples of a chirp.
+  uint32_t sample_stride;
+  // Distance in samples between the starts of two consecutive chirps.
+  uint32_t chirp_stride;
+  // Distance in samples between the starts of two consecutive channels.
+  uint32_t channel_stride;
+  // Size in bytes of a whole burst with samples packed by bits_per_sample.
+  uint32_t packed_size;
+  // Size in bytes of the burst data as read, including the padding
+  // implied by the strides. Equal to packed_size if there is no padding.
+  uint32_t buffer_size;
+  // Required alignment in bytes of the burst data buffer.
+  uint32_t alignment;
+  union {
+    struct {
+      // True/1 if channels and samples are interleaved.
+      uint16_t is_channels_interlieved: 1;
+      // True/1 if a word is in big endian.
+      uint16_t is_big_endian: 1;
+      // Reserved for future use.
+      uint16_t reserved: 14;
+    };
+    uint16_t flags;
+  };
+} RadarBurstLayout;
+
+// Memory used by the radar driver for a single sensor.
+typedef struct RadarMemoryUsage_s {
+  // Memory budget set with radarSetMemoryBudget, 0 if unlimited.
+  uint64_t budget_bytes;
+  // Total memory currently allocated for the sensor.
+  uint64_t used_bytes;
+  // Size of the largest single burst among the active configurations.
+  uint32_t burst_bytes;
+  // Amount of bursts the internal FIFO can hold.
+  uint32_t fifo_depth;
+  // Memory allocated for the internal FIFO.
+  uint64_t fifo_bytes;
+  // Memory allocated for burst buffer pools.
+  uint64_t pool_bytes;
+  // Memory allocated for processing and transfer workspaces.
+  uint64_t workspace_bytes;
+} RadarMemoryUsage;
+
 // A semantic version holder.
 typedef struct Version_s {
   uint8_t major;
@@ -209,6 +352,19 @@ typedef struct SensorInfo_s {
   RadarState state;
 } SensorInfo;
 
+// Selects which bursts the burst ready callback is invoked for.
+typedef struct RadarBurstReadyFilter_s {
+  // Bit N % 64 of slot_mask[N / 64] set to notify about bursts from config
+  // slot N, all zero for all slots.
+  uint64_t slot_mask[4];
+  // Notify about every Nth matching burst, 0 or 1 for every burst.
+  uint32_t decimation;
+  // The minimum time between two notifications, 0 for no limit. A
+  // notification that comes too early is deferred until the interval
+  // passed, never dropped; bursts in between are merged into it.
+  uint32_t min_interval_us;
+} RadarBurstReadyFilter;
+
 /*
  * @brief A callback function declaration that will be invoked
  *        when a new burst is ready for read. Can be set using
@@ -259,6 +415,40 @@ typedef void (*RadarRegisterSetCB)(uint32_t address, uint32_t value,
 //----- API ----------------------------
 //--------------------------------------
 
+/*
+ * Thread safety: for a single handle, functions are split into a data plane
+ * (radarIsBurstReady, radarReadBurst, radarReadBursts, radarReadBurstUntil,
+ * radarAcquireBurst, radarAcquireBursts, radarIsSlotBurstReady,
+ * radarReadSlotBurst, radarReleaseBurst) and a control plane (all other
+ * functions taking a handle).
+ *
+ * - One caller of radarIsBurstReady, radarReadBurst, radarReadBursts,
+ *   radarReadBurstUntil, radarAcquireBurst and radarAcquireBursts may run
+ *   concurrently with control plane calls.
+ * - In addition, one caller per config slot of radarIsSlotBurstReady and
+ *   radarReadSlotBurst may run concurrently with all of the above, so each
+ *   slot can be consumed by its own thread.
+ * - radarReleaseBurst may be called from any thread concurrently with any
+ *   other call, except radarDestroy.
+ * - Getters (radarGetState, radarIsActiveConfig, radarGetBurstLayout,
+ *   radarGet*Param*, radarGetMemoryUsage, radarGetSensorInfo) are safe to
+ *   call concurrently with data plane and control plane calls. They never
+ *   wait for a pending burst read, and a getter racing a setter returns
+ *   either the old or the new value, never a mix of both.
+ * - Only calls that change the burst layout or the stream of an active
+ *   slot (power management, radarActivateConfig, radarDeactivateConfig,
+ *   radarSet*Param on an active slot, radarStart/StopDataStreaming) may
+ *   wait until an in-progress read returns, and make pending reads return
+ *   RC_BAD_STATE if streaming stops. radarRestart is the exception:
+ *   pending reads keep waiting through it.
+ * - All other setters never wait for a read. radarSetFifoDepth and
+ *   radarSetMemoryBudget free a buffer that is being read into once that
+ *   read returns.
+ * - Control plane calls other than getters are not safe against each
+ *   other and must be serialized by the application. Lifecycle functions
+ *   must not run concurrently with any other call.
+ */
+
 // Lifecycle.
 
 /*
@@ -289,6 +479,9 @@ RadarHandle* radarCreate(int32_t id);
  * @brief Destroy a radar module instance.
  *
  * @param handle the handle of the radar instance to be destroyed.
+ *
+ * @note RC_BAD_STATE is returned while bursts borrowed with
+ *       radarAcquireBurst(s) have not been released.
  */
 RadarReturnCode radarDestroy(RadarHandle* handle);
 
@@ -330,6 +523,30 @@ RadarReturnCode radarGoSleep(RadarHandle* handle);
  */
 RadarReturnCode radarWakeUp(RadarHandle* handle);
 
+/*
+ * @brief Recover a stalled radar with the minimal sequence needed:
+ *        turn it off and on, restore its configuration and restart data
+ *        streaming if it was running. Callbacks, the FIFO and burst
+ *        buffers stay allocated.
+ *
+ * @param handle a handler for the radar instance to use.
+ *
+ * @note Everything set through this API is preserved: configuration
+ *       slots and active configs, FIFO mode, depth, keep-every-Nth and
+ *       slot priorities, memory budget, wait strategy, burst ready
+ *       coalescing and filter. config_generation does not change and
+ *       sequence_number continues without reset.
+ * @note Burst timestamps stay monotonic: the driver carries the sensor
+ *       time base over the power cycle instead of restarting it at 0.
+ * @note Reads that are waiting for a burst keep waiting through the
+ *       restart and return RC_TIMEOUT only if their own timeout or
+ *       deadline expires.
+ * @note Optional. Drivers that cannot preserve configuration over a
+ *       power cycle return RC_UNSUPPORTED; the application then has to
+ *       re-run the full initialization.
+ */
+RadarReturnCode radarRestart(RadarHandle* handle);
+
 // Configuration.
 
 /*
@@ -340,6 +557,112 @@ RadarReturnCode radarWakeUp(RadarHandle* handle);
  */
 RadarReturnCode radarSetFifoMode(RadarHandle* handle, RadarFifoMode mode);
 
+/*
+ * @brief Set the amount of bursts the internal FIFO can hold.
+ *
+ * @param handle a handler for the radar instance to use.
+ * @param depth a new FIFO depth, 0 to grow it automatically based on
+ *        observed consumer lag, bounded by the memory budget set with
+ *        radarSetMemoryBudget. The current depth is reported by
+ *        radarGetMemoryUsage.
+ *
+ * @note RC_RES_LIMIT is returned if the depth does not fit the memory
+ *       budget. RC_BAD_STATE is returned for depth 0 if no memory budget
+ *       is set, and radarSetMemoryBudget returns RC_BAD_STATE for an
+ *       unlimited budget while the depth is sized automatically.
+ */
+RadarReturnCode radarSetFifoDepth(RadarHandle* handle, uint32_t depth);
+
+/*
+ * @brief Set how many bursts can be borrowed with radarAcquireBurst(s) at
+ *        the same time. The driver keeps that many pool buffers besides
+ *        the FIFO, so held bursts never take FIFO space.
+ *
+ * @param handle a handler for the radar instance to use.
+ * @param count a new maximum amount of borrowed bursts, 1 by default.
+ *        0 disables borrowing.
+ *
+ * @note The buffers are counted in pool_bytes of radarGetMemoryUsage.
+ *       RC_RES_LIMIT is returned if they do not fit the memory budget, and
+ *       RC_BAD_STATE if count is lower than the amount of bursts currently
+ *       borrowed.
+ * @note Optional. Drivers without a shareable burst pool return
+ *       RC_UNSUPPORTED.
+ */
+RadarReturnCode radarSetMaxBorrowedBursts(RadarHandle* handle,
+    uint32_t count);
+
+/*
+ * @brief Set which new bursts are kept while the FIFO is full in
+ *        RFIFO_KEEP_NTH mode.
+ *
+ * @param handle a handler for the radar instance to use.
+ * @param n keep every Nth new burst while the FIFO is full, so N - 1
+ *        bursts are ignored per kept one. 1 keeps every new burst, same
+ *        as RFIFO_DROP_OLD. 0 is rejected with RC_BAD_INPUT. N is 2
+ *        until this is called.
+ */
+RadarReturnCode radarSetFifoKeepEveryNth(RadarHandle* handle, uint32_t n);
+
+/*
+ * @brief Set the priority of a config slot's bursts in
+ *        RFIFO_SLOT_PRIORITY mode.
+ *
+ * @param handle a handler for the radar instance to use.
+ * @param slot_id a configuration slot ID which priority to set.
+ * @param priority a new priority, bursts with lower values are dropped
+ *        first. All slots have priority 0 by default.
+ */
+RadarReturnCode radarSetSlotPriority(RadarHandle* handle, int8_t slot_id,
+    uint8_t priority);
+
+/*
+ * @brief Set how burst reads wait for a burst that is not ready yet.
+ *        Spinning trades CPU time for lower wake-up latency.
+ *
+ * @param handle a handler for the radar instance to use.
+ * @param strategy a new wait strategy.
+ * @param spin_us the maximum time to spin before blocking, used only
+ *        with RWAIT_SPIN_THEN_BLOCK. 0 makes it behave like RWAIT_BLOCK.
+ *
+ * @note The strategy applies to every read and acquire function of the
+ *       handle. RWAIT_BLOCK is used until this function is called.
+ * @note RC_BAD_INPUT is returned for RWAIT_UNDEFINED.
+ * @note Optional. Drivers that only block return RC_UNSUPPORTED for
+ *       other strategies.
+ */
+RadarReturnCode radarSetWaitStrategy(RadarHandle* handle,
+    RadarWaitStrategy strategy, uint32_t spin_us);
+
+/*
+ * @brief Set the maximum amount of memory the driver may allocate for
+ *        this sensor. FIFO depth, buffer pools and workspaces are derived
+ *        from the budget and the burst size of the active configuration.
+ *
+ * @param handle a handler for the radar instance to use.
+ * @param max_bytes a new memory budget in bytes, 0 for unlimited.
+ *
+ * @note Optional. Drivers without memory budget support return
+ *       RC_UNSUPPORTED.
+ * @note If the new budget is below the current usage, the FIFO, pools
+ *       and workspaces are shrunk to fit. RC_RES_LIMIT is returned and
+ *       the budget is left unchanged if they cannot be shrunk enough,
+ *       including when the budget cannot hold a single burst of an
+ *       active configuration.
+ * @note RC_BAD_STATE is returned for an unlimited budget while the FIFO
+ *       depth is sized automatically with radarSetFifoDepth(0).
+ */
+RadarReturnCode radarSetMemoryBudget(RadarHandle* handle, uint64_t max_bytes);
+
+/*
+ * @brief Get the memory budget and the actual memory usage.
+ *
+ * @param handle a handler for the radar instance to use.
+ * @param usage a pointer where the memory usage will be written into.
+ */
+RadarReturnCode radarGetMemoryUsage(RadarHandle* handle,
+    RadarMemoryUsage* usage);
+
 /*
  * Get the total available configuration slots.
  *
@@ -355,7 +678,8 @@ RadarReturnCode radarGetNumConfigSlots(RadarHandle* handle, int8_t* num_slots);
  * @param slot_id a configuration slot ID to activate.
  *
  * @note This function will perform the final configuration check for
- *       compatibility before activating.
+ *       compatibility before activating. RC_RES_LIMIT is returned if
+ *       the memory budget cannot hold even a single burst.
  */
 RadarReturnCode radarActivateConfig(RadarHandle* handle, int8_t slot_id);
 
@@ -377,6 +701,19 @@ RadarReturnCode radarDeactivateConfig(RadarHandle* handle, int8_t slot_id);
 RadarReturnCode radarIsActiveConfig(RadarHandle* handle, int8_t slot_id,
     bool* is_active);
 
+/*
+ * @brief Get the memory layout of bursts generated by a config slot.
+ *
+ * @param handle a handler for the radar instance to use.
+ * @param slot_id a configuration slot ID which layout to read.
+ * @param layout a pointer where the burst layout will be written into.
+ *
+ * @note The layout is valid as long as the slot's config_generation
+ *       matches the one in RadarBurstFormatExt and is not 0.
+ */
+RadarReturnCode radarGetBurstLayout(RadarHandle* handle, int8_t slot_id,
+    RadarBurstLayout* layout);
+
 /*
  * @brief Get a main radar parameter.
  *
@@ -394,6 +731,10 @@ RadarReturnCode radarGetMainParam(RadarHandle* handle, uint32_t slot_id,
  * @param slot_id a configuration slot ID where to set a new parameter value.
  * @param id a parameter ID to be set.
  * @param value a new value for the parameter.
+ *
+ * @note RC_RES_LIMIT is returned and the value is left unchanged if the
+ *       slot is active and the new burst size does not fit the memory
+ *       budget.
  */
 RadarReturnCode radarSetMainParam(RadarHandle* handle, uint32_t slot_id,
     RadarMainParam id, uint32_t value);
@@ -462,6 +803,10 @@ RadarReturnCode radarGetVendorParam(RadarHandle* handle, uint32_t slot_id,
  * @param slot_id a configuration slot ID where to set a new parameter value.
  * @param id a parameter ID to set.
  * @param value a new value for the parameter.
+ *
+ * @note RC_RES_LIMIT is returned and the value is left unchanged if the
+ *       slot is active and the new burst size does not fit the memory
+ *       budget.
  */
 RadarReturnCode radarSetVendorParam(RadarHandle* handle, uint32_t slot_id,
     RadarVendorParam id, uint32_t value);
@@ -500,10 +845,163 @@ RadarReturnCode radarIsBurstReady(RadarHandle* handle, bool* is_ready);
  *        When function finishes, the pointer will have the amount of bytes
  *        have been read.
  * @param timeout the maximum time to wait if the burst frame is not ready.
+ *
+ * @note Only RadarBurstFormat is written. Use radarReadBurstUntil to get
+ *       RadarBurstFormatExt.
  */
 RadarReturnCode radarReadBurst(RadarHandle* handle, RadarBurstFormat* format,
     uint8_t* buffer, uint32_t* read_bytes, struct timespec timeout);
 
+/*
+ * @brief Read several bursts at once. Waits for the first burst like
+ *        radarReadBurstUntil, then reads bursts that are already in the
+ *        FIFO without waiting for more. Each burst starts at an offset
+ *        padded up to the alignment of its RadarBurstLayout.
+ *
+ * @param handle a handler for the radar instance to use.
+ * @param formats a pointer to an array where burst formats will be written.
+ * @param buffer a pointer where data of all bursts to write, aligned to
+ *        the largest alignment among the active configurations.
+ * @param burst_offsets a pointer to an array where the offset in buffer of
+ *        each burst will be written.
+ * @param burst_bytes a pointer to an array where the size of each burst
+ *        will be written.
+ * @param read_bytes a pointer where the maximum buffer size is set.
+ *        When function finishes, the pointer will have the amount of bytes
+ *        have been read, including padding.
+ * @param count a pointer where the maximum amount of bursts is set, limited
+ *        by the size of formats, burst_offsets and burst_bytes arrays. When
+ *        function finishes, the pointer will have the amount of bursts have
+ *        been read.
+ * @param deadline the CLOCK_MONOTONIC time after which RC_TIMEOUT is
+ *        returned if no burst frame is ready.
+ *
+ * @note A burst that does not fit the remaining buffer space stays queued
+ *       for the next read instead of being truncated or dropped. If even
+ *       the first burst does not fit, RC_BAD_INPUT is returned.
+ */
+RadarReturnCode radarReadBursts(RadarHandle* handle,
+    RadarBurstFormatExt* formats, uint8_t* buffer, uint32_t* burst_offsets,
+    uint32_t* burst_bytes, uint32_t* read_bytes, uint32_t* count,
+    struct timespec deadline);
+
+/*
+ * @brief Initiate reading a new burst, waiting no later than an absolute
+ *        deadline. Unlike radarReadBurst, retrying with the same deadline
+ *        does not accumulate drift.
+ *
+ * @param handle a handler for the radar instance to use.
+ * @param format a pointer where a new burst format will be written into.
+ * @param buffer a pointer where a burst data to write.
+ * @param read_bytes a pointer where the maximum buffer size is set.
+ *        When function finishes, the pointer will have the amount of bytes
+ *        have been read.
+ * @param deadline the CLOCK_MONOTONIC time after which RC_TIMEOUT is
+ *        returned if the burst frame is not ready.
+ */
+RadarReturnCode radarReadBurstUntil(RadarHandle* handle,
+    RadarBurstFormatExt* format, uint8_t* buffer, uint32_t* read_bytes,
+    struct timespec deadline);
+
+/*
+ * @brief Check if the radar has a new burst ready to read that was
+ *        generated by the specified configuration slot.
+ *
+ * @param handle a handler for the radar instance to use.
+ * @param slot_id a configuration slot ID which bursts to check.
+ * @param is_ready a pointer where the result will be set.
+ *
+ * @note Optional. Drivers that do not keep a separate queue per
+ *       configuration slot return RC_UNSUPPORTED.
+ */
+RadarReturnCode radarIsSlotBurstReady(RadarHandle* handle, int8_t slot_id,
+    bool* is_ready);
+
+/*
+ * @brief Initiate reading a new burst generated by the specified
+ *        configuration slot. Bursts from other active slots stay queued
+ *        and can be read with radarReadSlotBurst for their own slot ID, so
+ *        interleaved slots can be consumed by separate processing chains.
+ *
+ * @param handle a handler for the radar instance to use.
+ * @param slot_id a configuration slot ID which burst to read.
+ * @param format a pointer where a new burst format will be written into.
+ * @param buffer a pointer where a burst data to write.
+ * @param read_bytes a pointer where the maximum buffer size is set.
+ *        When function finishes, the pointer will have the amount of bytes
+ *        have been read.
+ * @param deadline the CLOCK_MONOTONIC time after which RC_TIMEOUT is
+ *        returned if the burst frame is not ready.
+ *
+ * @note Optional. Drivers that do not keep a separate queue per
+ *       configuration slot return RC_UNSUPPORTED.
+ * @note radarReadBurst keeps returning the oldest burst of any slot and may be
+ *       mixed with per-slot reads; every burst is returned only once.
+ *       FIFO depth and the radarSetFifoMode overflow policy apply to the
+ *       whole FIFO shared by all slots, not to each slot separately.
+ */
+RadarReturnCode radarReadSlotBurst(RadarHandle* handle, int8_t slot_id,
+    RadarBurstFormatExt* format, uint8_t* buffer, uint32_t* read_bytes,
+    struct timespec deadline);
+
+/*
+ * @brief Borrow the next burst directly from the driver's burst buffer
+ *        pool instead of copying it. The buffer is not reused by the
+ *        driver until it is returned with radarReleaseBurst.
+ *
+ * @param handle a handler for the radar instance to use.
+ * @param burst a pointer where the borrowed burst will be written into.
+ * @param deadline the CLOCK_MONOTONIC time after which RC_TIMEOUT is
+ *        returned if the burst frame is not ready.
+ *
+ * @note Optional. Drivers without a shareable burst pool return
+ *       RC_UNSUPPORTED.
+ * @note A borrowed burst is removed from the FIFO and no longer counts
+ *       against its depth, so overflow policies never evict it. If
+ *       radarSetMaxBorrowedBursts bursts are already borrowed, RC_RES_LIMIT
+ *       is returned and the burst stays in the FIFO.
+ * @note A borrowed buffer stays valid until it is released, including
+ *       across radarStopDataStreaming, radarDeactivateConfig and
+ *       radarRestart. A shrinking radarSetMemoryBudget or radarSetFifoDepth
+ *       never reclaims borrowed buffers and returns RC_RES_LIMIT if it
+ *       would need them. radarDestroy returns RC_BAD_STATE while any
+ *       buffer is still borrowed.
+ */
+RadarReturnCode radarAcquireBurst(RadarHandle* handle,
+    RadarBorrowedBurst* burst, struct timespec deadline);
+
+/*
+ * @brief Borrow several bursts at once. Waits for the first burst like
+ *        radarAcquireBurst, then borrows bursts that are already in the
+ *        FIFO without waiting for more.
+ *
+ * @param handle a handler for the radar instance to use.
+ * @param bursts a pointer to an array where borrowed bursts will be written.
+ * @param count a pointer where the size of the bursts array is set. When
+ *        function finishes, the pointer will have the amount of bursts
+ *        have been borrowed.
+ * @param deadline the CLOCK_MONOTONIC time after which RC_TIMEOUT is
+ *        returned if no burst frame is ready.
+ *
+ * @note Optional, same rules as for radarAcquireBurst apply to every burst.
+ *       Borrowing stops early when the radarSetMaxBorrowedBursts limit is
+ *       reached.
+ */
+RadarReturnCode radarAcquireBursts(RadarHandle* handle,
+    RadarBorrowedBurst* bursts, uint32_t* count, struct timespec deadline);
+
+/*
+ * @brief Return a burst borrowed with radarAcquireBurst(s) to the driver.
+ *
+ * @param handle a handler for the radar instance to use.
+ * @param token the token of the borrowed burst.
+ *
+ * @note RC_BAD_INPUT is returned if the token does not identify a current
+ *       borrow, including one that has already been released. A stale
+ *       token never releases a buffer lent out again later.
+ */
+RadarReturnCode radarReleaseBurst(RadarHandle* handle, RadarBurstToken token);
+
 // Feedback.
 
 /*
@@ -516,6 +1014,44 @@ RadarReturnCode radarReadBurst(RadarHandle* handle, RadarBurstFormat* format,
 RadarReturnCode radarSetBurstReadyCb(RadarHandle* handle, RadarBurstReadyCB cb,
     void* user_data);
 
+/*
+ * @brief Set a filter that selects which bursts the burst ready callback is
+ *        invoked for. The filter is evaluated per burst before coalescing.
+ *
+ * @param handle a handler for the radar instance to use.
+ * @param filter a pointer to the filter to use, NULL to notify about
+ *        every burst. Replaces the previously set filter.
+ *
+ * @note The filter only selects callbacks, not data: radarReadBurst still
+ *       returns the oldest burst of the shared FIFO, which may come from
+ *       another slot or be one skipped by decimation. Read with
+ *       radarReadSlotBurst, or drain and discard bursts that do not match.
+ */
+RadarReturnCode radarSetBurstReadyFilter(RadarHandle* handle,
+    const RadarBurstReadyFilter* filter);
+
+/*
+ * @brief Coalesce burst ready callbacks so the callback is invoked once for
+ *        several bursts instead of once per burst. The callback is invoked
+ *        when max_bursts bursts are pending or max_delay_us passed since
+ *        the first pending burst, whichever comes first. Pending bursts can
+ *        be drained with radarReadBursts.
+ *
+ * @param handle a handler for the radar instance to use.
+ * @param max_bursts amount of bursts to wait for, 0 or 1 disables
+ *        coalescing.
+ * @param max_delay_us the maximum delay of a callback. Must not be 0 when
+ *        max_bursts is above 1, otherwise RC_BAD_INPUT is returned.
+ *
+ * @note Only bursts that pass radarSetBurstReadyFilter count as pending,
+ *       and max_delay_us is measured from the first such burst.
+ * @note Pending callbacks are flushed by radarStopDataStreaming, so
+ *       fewer than max_bursts bursts left at the end of a stream are
+ *       still signalled.
+ */
+RadarReturnCode radarSetBurstReadyCoalescing(RadarHandle* handle,
+    uint32_t max_bursts, uint32_t max_delay_us);
+
 /*
  * @biref Set a callback that will be invoked with a log message from
  *        the radar API impl.
@@ -71,7 +71,34 @@ enum FifoMode {
   // A new burst will be ignored.
   RFIFO_DROP_NEW,
   // The oldest burst(s) will be dropped to release space for a new burst.
-  RFIFO_DROP_OLD
+  RFIFO_DROP_OLD,
+  // While the fifo is full, only every Nth new burst will be kept, with N
+  // set by SetFifoKeepEveryNth, 2 by default. The oldest burst is
+  // dropped to release space for a kept burst, the others are ignored.
+  RFIFO_KEEP_NTH,
+  // The oldest burst among those from the config slot(s) with the lowest
+  // priority, including the new burst, will be dropped. Priorities are set
+  // by SetSlotPriority and are 0 by default, so equal priorities
+  // behave like RFIFO_DROP_OLD.
+  RFIFO_SLOT_PRIORITY,
+  // The producer will wait until there is space for a new burst.
+  // Intended for replay drivers where no real-time data can be lost.
+  // Borrowed bursts do not take FIFO space, so holding them never blocks
+  // the producer.
+  // Drivers for live hardware return RC_UNSUPPORTED for this mode.
+  RFIFO_BLOCK_PRODUCER
+};
+
+// Defines how a read waits for a burst that is not ready yet.
+enum WaitStrategy {
+  // A default undefined value that should be used at initialization.
+  RWAIT_UNDEFINED = 0,
+  // Block in the kernel until the burst is ready or the read times out.
+  RWAIT_BLOCK,
+  // Poll IsBurstReady for a bounded spin time, then block.
+  RWAIT_SPIN_THEN_BLOCK,
+  // Poll IsBurstReady until the burst is ready or the read times out.
+  RWAIT_BUSY_POLL
 };
 
 //--------------------------------------
@@ -163,10 +190,110 @@ struct BurstFormat {
   bool is_big_endian;
   // CRC for the current burst data buffer.
   uint32_t burst_data_crc;
-  // Timestamp when the burst was created since radar was turned on.
+  // Timestamp when the burst was created since radar was first turned on.
+  // Keeps counting across Restart.
+  // Wraps after ~49 days, prefer BurstFormatExt::sensor_timestamp_ns.
   uint32_t timestamp_ms;
 };
 
+// An extended data format of burst data, filled in by the read methods
+// added after ReadBurst. ReadBurst keeps writing only BurstFormat, so
+// applications built against older headers stay safe.
+struct BurstFormatExt {
+  // Size of this struct in bytes, set by the caller before a read. The driver
+  // only writes fields that fit into it, so fields added later never overflow
+  // an older caller. RC_BAD_INPUT is returned if it cannot hold format.
+  uint32_t struct_size;
+  // The basic data format of the burst.
+  BurstFormat format;
+  // True if the *_timestamp_ns fields below are filled in.
+  bool has_extended_timestamps;
+  // Timestamp in nanoseconds when the burst was created since radar was
+  // first turned on, in the sensor clock domain. Keeps counting across
+  // Restart and does not wrap in practice.
+  // Valid only if has_extended_timestamps is set.
+  uint64_t sensor_timestamp_ns;
+  // CLOCK_MONOTONIC time in nanoseconds when the host started receiving
+  // the burst. Valid only if has_extended_timestamps is set.
+  uint64_t host_receive_timestamp_ns;
+  // CLOCK_MONOTONIC time in nanoseconds when the burst transfer to the host
+  // completed. Valid only if has_extended_timestamps is set.
+  uint64_t transfer_complete_timestamp_ns;
+  // Generation of the config slot, incremented every time it is changed.
+  // Starts at 1, 0 if the driver does not track generations.
+  uint32_t config_generation;
+};
+
+// Identifies a burst borrowed with AcquireBurst. A new token is issued for
+// every borrow and never reused for the lifetime of the sensor, 0 is never
+// a valid token.
+typedef uint64_t BurstToken;
+
+// A burst borrowed from the driver's burst buffer pool.
+struct BorrowedBurst {
+  // Token to return the burst with ReleaseBurst.
+  BurstToken token;
+  // Burst data owned by the driver, valid until the burst is released.
+  const uint8_t* data;
+  // Size of the burst data in bytes.
+  uint32_t size;
+  // Data format of the burst.
+  BurstFormatExt format;
+};
+
+// Describes the memory layout of bursts generated by a config slot.
+// Stays the same for all bursts with matching config_id and
+// config_generation, so it can be computed once and cached.
+struct BurstLayout {
+  // Config slot ID the layout belongs to.
+  uint8_t config_id;
+  // Generation of the config slot the layout was computed for, 0 if the
+  // driver does not track generations. A layout with generation 0 must
+  // not be cached.
+  uint32_t config_generation;
+  // Amount of bits per single sample.
+  uint8_t bits_per_sample;
+  // Amount of samples per single chirp.
+  uint16_t samples_per_chirp;
+  // Amount of active channels in a burst.
+  uint8_t channels_count;
+  // Amount of chirps in a burst.
+  uint8_t chirps_per_burst;
+  // Distance in samples between two consecutive samples of a chirp.
+  uint32_t sample_stride;
+  // Distance in samples between the starts of two consecutive chirps.
+  uint32_t chirp_stride;
+  // Distance in samples between the starts of two consecutive channels.
+  uint32_t channel_stride;
+  // Size in bytes of a whole burst with samples packed by bits_per_sample.
+  uint32_t packed_size;
+  // Size in bytes of the burst data as read, including the padding
+  // implied by the strides. Equal to packed_size if there is no padding.
+  uint32_t buffer_size;
+  // Required alignment in bytes of the burst data buffer.
+  uint32_t alignment;
+  bool is_channels_interlieved;
+  bool is_big_endian;
+};
+
+// Memory used by the radar driver for a single sensor.
+struct MemoryUsage {
+  // Memory budget set with SetMemoryBudget, 0 if unlimited.
+  uint64_t budget_bytes;
+  // Total memory currently allocated for the sensor.
+  uint64_t used_bytes;
+  // Size of the largest single burst among the active configurations.
+  uint32_t burst_bytes;
+  // Amount of bursts the internal FIFO can hold.
+  uint32_t fifo_depth;
+  // Memory allocated for the internal FIFO.
+  uint64_t fifo_bytes;
+  // Memory allocated for burst buffer pools.
+  uint64_t pool_bytes;
+  // Memory allocated for processing and transfer workspaces.
+  uint64_t workspace_bytes;
+};
+
 // A semantic version holder.
 struct Version {
   uint8_t major;
@@ -193,6 +320,19 @@ struct SensorInfo {
   RadarState state;
 };
 
+// Selects which bursts an observer gets OnBurstReady notifications for.
+struct ObserverFilter {
+  // Bit N % 64 of slot_mask[N / 64] set to notify about bursts from config
+  // slot N, all zero for all slots.
+  uint64_t slot_mask[4];
+  // Notify about every Nth matching burst, 0 or 1 for every burst.
+  uint32_t decimation;
+  // The minimum time between two notifications, 0 for no limit. A
+  // notification that comes too early is deferred until the interval
+  // passed, never dropped; bursts in between are merged into it.
+  uint32_t min_interval_us;
+};
+
 /*
  * @brief A Radar data observer that allows application to be notified
  *        about it's events.
@@ -244,6 +384,39 @@ class IRadarSensorObserver {
 //----- API ----------------------------
 //--------------------------------------
 
+/*
+ * @brief A radar sensor driver interface.
+ *
+ * Thread safety: methods are split into a data plane (IsBurstReady,
+ * ReadBurst, ReadBursts, ReadBurstUntil, AcquireBurst, AcquireBursts,
+ * IsSlotBurstReady, ReadSlotBurst, ReleaseBurst) and a control plane (all
+ * other methods).
+ *
+ * - One caller of IsBurstReady, ReadBurst, ReadBursts, ReadBurstUntil,
+ *   AcquireBurst and AcquireBursts may run concurrently with control plane
+ *   calls.
+ * - In addition, one caller per config slot of IsSlotBurstReady and
+ *   ReadSlotBurst may run concurrently with all of the above, so each slot
+ *   can be consumed by its own thread.
+ * - ReleaseBurst may be called from any thread concurrently with any other
+ *   call.
+ * - Getters (GetRadarState, GetActiveConfigs, GetBurstLayout, Get*Param*,
+ *   GetMemoryUsage, GetSensorInfo) are safe to call concurrently with data
+ *   plane and control plane calls. They never wait for a pending burst
+ *   read, and a getter racing a setter returns either the old or the new
+ *   value, never a mix of both.
+ * - Only calls that change the burst layout or the stream of an active
+ *   slot (power management, ActivateConfig, DeactivateConfig, Set*Param
+ *   on an active slot, Start/StopDataStreaming) may wait until an
+ *   in-progress read returns, and make pending reads return RC_BAD_STATE
+ *   if streaming stops. Restart is the exception: pending reads keep
+ *   waiting through it.
+ * - All other setters never wait for a read. SetFifoDepth and
+ *   SetMemoryBudget free a buffer that is being read into once that read
+ *   returns.
+ * - Control plane calls other than getters are not safe against each
+ *   other and must be serialized by the application.
+ */
 class IRadarSensor {
  public:
   // Feedback
@@ -253,9 +426,32 @@ class IRadarSensor {
    * the Radar sensor activity.
    *
    * @param observer pointer to the implmenetation of the interface to add.
+   *
+   * @note Adding an already registered observer does not register it twice
+   *       and removes its filter, if any.
    */
   virtual ReturnCode AddObserver(IRadarSensorObserver* observer) = 0;
 
+  /*
+   * @brief Add a new observer object that will get notified about
+   * the Radar sensor activity, with OnBurstReady delivered only for bursts
+   * that pass the filter. Filters are evaluated per burst before
+   * coalescing, so observers without matching bursts are not woken up.
+   *
+   * @note The filter only selects notifications, not data: ReadBurst still
+   *       returns the oldest burst of the shared FIFO, which may come from
+   *       another slot or be one skipped by decimation. Filtered observers
+   *       should read with ReadSlotBurst, or drain and discard bursts that
+   *       do not match.
+   * @note Adding an already registered observer does not register it twice
+   *       and replaces its filter, so this is also how a filter is changed.
+   *
+   * @param observer pointer to the implmenetation of the interface to add.
+   * @param filter which bursts to notify the observer about.
+   */
+  virtual ReturnCode AddObserver(IRadarSensorObserver* observer,
+                                 const ObserverFilter& filter) = 0;
+
   /*
    * @brief Remove the previously registered observer from subscribers list.
    *
@@ -263,6 +459,28 @@ class IRadarSensor {
    */
   virtual ReturnCode RemoveObserver(IRadarSensorObserver* observer) = 0;
 
+  /*
+   * @brief Coalesce burst ready notifications so observers are notified
+   *        once for several bursts instead of once per burst. A
+   *        notification is delivered when max_bursts bursts are pending or
+   *        max_delay_us passed since the first pending burst, whichever
+   *        comes first. Pending bursts can be drained with ReadBursts.
+   *
+   * @param max_bursts amount of bursts to wait for, 0 or 1 disables
+   *        coalescing.
+   * @param max_delay_us the maximum delay of a notification. Must not be 0
+   *        when max_bursts is above 1, otherwise RC_BAD_INPUT is returned.
+   *
+   * @note Applies to both observers and the C API burst ready callback.
+   *       Pending bursts are counted per observer, only those that pass its
+   *       filter, and max_delay_us is measured from the first such burst.
+   * @note Pending notifications are flushed by StopDataStreaming, so fewer
+   *       than max_bursts bursts left at the end of a stream are still
+   *       signalled.
+   */
+  virtual ReturnCode SetBurstReadyCoalescing(uint32_t max_bursts,
+                                             uint32_t max_delay_us) = 0;
+
 
   // Power management.
 
@@ -293,6 +511,28 @@ class IRadarSensor {
    */
   virtual ReturnCode WakeUp(void) = 0;
 
+  /*
+   * @brief Recover a stalled radar with the minimal sequence needed:
+   *        turn it off and on, restore its configuration and restart data
+   *        streaming if it was running. Observers, the FIFO and burst
+   *        buffers stay allocated.
+   *
+   * @note Everything set through this interface is preserved:
+   *       configuration slots and active configs, FIFO mode, depth,
+   *       keep-every-Nth and slot priorities, memory budget, wait strategy,
+   *       burst ready coalescing and observer filters. config_generation
+   *       does not change and sequence_number continues without reset.
+   * @note Burst timestamps stay monotonic: the driver carries the sensor
+   *       time base over the power cycle instead of restarting it at 0.
+   * @note Reads that are waiting for a burst keep waiting through the
+   *       restart and return RC_TIMEOUT only if their own timeout or
+   *       deadline expires.
+   * @note Optional. Drivers that cannot preserve configuration over a
+   *       power cycle return RC_UNSUPPORTED; the application then has to
+   *       re-run the full initialization.
+   */
+  virtual ReturnCode Restart(void) { return RC_UNSUPPORTED; }
+
   // Configuration.
 
   /*
@@ -302,6 +542,107 @@ class IRadarSensor {
    */
   virtual ReturnCode SetFifoMode(FifoMode mode) = 0;
 
+  /*
+   * @brief Set the amount of bursts the internal FIFO can hold.
+   *
+   * @param depth a new FIFO depth, 0 to grow it automatically based on
+   *        observed consumer lag, bounded by the memory budget set with
+   *        SetMemoryBudget. The current depth is reported by GetMemoryUsage.
+   *
+   * @note RC_RES_LIMIT is returned if the depth does not fit the memory
+   *       budget. RC_BAD_STATE is returned for depth 0 if no memory budget
+   *       is set, and SetMemoryBudget returns RC_BAD_STATE for an unlimited
+   *       budget while the depth is sized automatically.
+   */
+  virtual ReturnCode SetFifoDepth(uint32_t depth) = 0;
+
+  /*
+   * @brief Set how many bursts can be borrowed with AcquireBurst(s) at the
+   *        same time. The driver keeps that many pool buffers besides the
+   *        FIFO, so held bursts never take FIFO space.
+   *
+   * @param count a new maximum amount of borrowed bursts, 1 by default.
+   *        0 disables borrowing.
+   *
+   * @note The buffers are counted in MemoryUsage::pool_bytes. RC_RES_LIMIT
+   *       is returned if they do not fit the memory budget, and
+   *       RC_BAD_STATE if count is lower than the amount of bursts
+   *       currently borrowed.
+   * @note Optional. Drivers without a shareable burst pool return
+   *       RC_UNSUPPORTED.
+   */
+  virtual ReturnCode SetMaxBorrowedBursts(uint32_t /*count*/) {
+    return RC_UNSUPPORTED;
+  }
+
+  /*
+   * @brief Set which new bursts are kept while the FIFO is full in
+   *        RFIFO_KEEP_NTH mode.
+   *
+   * @param n keep every Nth new burst while the FIFO is full, so N - 1
+   *        bursts are ignored per kept one. 1 keeps every new burst, same
+   *        as RFIFO_DROP_OLD. 0 is rejected with RC_BAD_INPUT. N is 2
+   *        until this is called.
+   */
+  virtual ReturnCode SetFifoKeepEveryNth(uint32_t n) = 0;
+
+  /*
+   * @brief Set the priority of a config slot's bursts in
+   *        RFIFO_SLOT_PRIORITY mode.
+   *
+   * @param slot_id a configuration slot ID which priority to set.
+   * @param priority a new priority, bursts with lower values are dropped
+   *        first. All slots have priority 0 by default.
+   */
+  virtual ReturnCode SetSlotPriority(uint8_t slot_id, uint8_t priority) = 0;
+
+  /*
+   * @brief Set how burst reads wait for a burst that is not ready yet.
+   *        Spinning trades CPU time for lower wake-up latency.
+   *
+   * @param strategy a new wait strategy.
+   * @param spin_us the maximum time to spin before blocking, used only
+   *        with RWAIT_SPIN_THEN_BLOCK. 0 makes it behave like RWAIT_BLOCK.
+   *
+   * @note The strategy applies to every read and acquire method.
+   *       RWAIT_BLOCK is used until this method is called.
+   * @note RC_BAD_INPUT is returned for RWAIT_UNDEFINED.
+   * @note Optional. Drivers that only block return RC_UNSUPPORTED for
+   *       other strategies.
+   */
+  virtual ReturnCode SetWaitStrategy(WaitStrategy /*strategy*/,
+                                     uint32_t /*spin_us*/) {
+    return RC_UNSUPPORTED;
+  }
+
+  /*
+   * @brief Set the maximum amount of memory the driver may allocate for
+   *        this sensor. FIFO depth, buffer pools and workspaces are derived
+   *        from the budget and the burst size of the active configuration.
+   *
+   * @param max_bytes a new memory budget in bytes, 0 for unlimited.
+   *
+   * @note Optional. Drivers without memory budget support return
+   *       RC_UNSUPPORTED.
+   * @note If the new budget is below the current usage, the FIFO, pools
+   *       and workspaces are shrunk to fit. RC_RES_LIMIT is returned and
+   *       the budget is left unchanged if they cannot be shrunk enough,
+   *       including when the budget cannot hold a single burst of an
+   *       active configuration.
+   * @note RC_BAD_STATE is returned for an unlimited budget while the FIFO
+   *       depth is sized automatically with SetFifoDepth(0).
+   */
+  virtual ReturnCode SetMemoryBudget(uint64_t /*max_bytes*/) {
+    return RC_UNSUPPORTED;
+  }
+
+  /*
+   * @brief Get the memory budget and the actual memory usage.
+   *
+   * @param usage where the memory usage will be written into.
+   */
+  virtual ReturnCode GetMemoryUsage(MemoryUsage& usage) = 0;
+
   /*
    * Get the total available configuration slots.
    *
@@ -315,7 +656,8 @@ class IRadarSensor {
    * @param slot_id a configuration slot ID to activate.
    *
    * @note This function will perform the final configuration check for
-   *       compatibility before activating.
+   *       compatibility before activating. RC_RES_LIMIT is returned if
+   *       the memory budget cannot hold even a single burst.
    */
   virtual ReturnCode ActivateConfig(uint8_t slot_id) = 0;
 
@@ -334,6 +676,17 @@ class IRadarSensor {
    */
   virtual ReturnCode GetActiveConfigs(std::vector<uint8_t>& slot_ids) = 0;
 
+  /*
+   * @brief Get the memory layout of bursts generated by a config slot.
+   *
+   * @param slot_id a configuration slot ID which layout to read.
+   * @param layout where the burst layout will be written into.
+   *
+   * @note The layout is valid as long as the slot's config_generation
+   *       matches the one in BurstFormatExt and is not 0.
+   */
+  virtual ReturnCode GetBurstLayout(uint8_t slot_id, BurstLayout& layout) = 0;
+
   /*
    * @brief Get a main radar parameter.
    *
@@ -350,6 +703,10 @@ class IRadarSensor {
    * @param slot_id a configuration slot ID where to set a new parameter value.
    * @param id a parameter ID to be set.
    * @param value a new value for the parameter.
+   *
+   * @note RC_RES_LIMIT is returned and the value is left unchanged if the
+   *       slot is active and the new burst size does not fit the memory
+   *       budget.
    */
   virtual ReturnCode SetMainParam(uint32_t slot_id, MainParam id,
                                   uint32_t value) = 0;
@@ -411,6 +768,10 @@ class IRadarSensor {
    * @param slot_id a configuration slot ID where to set a new parameter value.
    * @param id a parameter ID to set.
    * @param value a new value for the parameter.
+   *
+   * @note RC_RES_LIMIT is returned and the value is left unchanged if the
+   *       slot is active and the new burst size does not fit the memory
+   *       budget.
    */
   virtual ReturnCode SetVendorParam(uint32_t slot_id, VendorParam id, uint32_t value) = 0;
 
@@ -439,11 +800,144 @@ class IRadarSensor {
    * @param format where a new burst format will be written into.
    * @param raw_radar_data where a burst data to be written.
    * @param timeout the maximum time to wait if the burst frame is not ready.
+   *
+   * @note Only BurstFormat is written. Use ReadBurstUntil to get
+   *       BurstFormatExt.
    */
   virtual ReturnCode ReadBurst(BurstFormat& format,
                                std::vector<uint8_t>& raw_radar_data,
                                timespec timeout) = 0;
 
+  /*
+   * @brief Read several bursts at once. Waits for the first burst like
+   *        ReadBurstUntil, then reads up to max_bursts bursts that are
+   *        already in the FIFO without waiting for more.
+   *
+   * @param formats where the burst formats will be written into.
+   * @param raw_radar_data where the data of each burst to be written.
+   * @param max_bursts the maximum amount of bursts to read.
+   * @param deadline the CLOCK_MONOTONIC time after which RC_TIMEOUT is
+   *        returned if no burst frame is ready.
+   */
+  virtual ReturnCode ReadBursts(
+      std::vector<BurstFormatExt>& formats,
+      std::vector<std::vector<uint8_t>>& raw_radar_data,
+      uint32_t max_bursts, timespec deadline) = 0;
+
+  /*
+   * @brief Initiate reading a new burst, waiting no later than an absolute
+   *        deadline. Unlike ReadBurst, retrying with the same deadline does
+   *        not accumulate drift.
+   *
+   * @param format where a new burst format will be written into.
+   * @param raw_radar_data where a burst data to be written.
+   * @param deadline the CLOCK_MONOTONIC time after which RC_TIMEOUT is
+   *        returned if the burst frame is not ready.
+   */
+  virtual ReturnCode ReadBurstUntil(BurstFormatExt& format,
+                                    std::vector<uint8_t>& raw_radar_data,
+                                    timespec deadline) = 0;
+
+  /*
+   * @brief Check if the radar has a new burst ready to read that was
+   *        generated by the specified configuration slot.
+   *
+   * @param slot_id a configuration slot ID which bursts to check.
+   * @param is_ready where the result will be set.
+   *
+   * @note Optional. Drivers that do not keep a separate queue per
+   *       configuration slot return RC_UNSUPPORTED.
+   */
+  virtual ReturnCode IsSlotBurstReady(uint8_t /*slot_id*/,
+                                      bool& /*is_ready*/) {
+    return RC_UNSUPPORTED;
+  }
+
+  /*
+   * @brief Initiate reading a new burst generated by the specified
+   *        configuration slot. Bursts from other active slots stay queued
+   *        and can be read with ReadSlotBurst for their own slot ID, so
+   *        interleaved slots can be consumed by separate processing chains.
+   *
+   * @param slot_id a configuration slot ID which burst to read.
+   * @param format where a new burst format will be written into.
+   * @param raw_radar_data where a burst data to be written.
+   * @param deadline the CLOCK_MONOTONIC time after which RC_TIMEOUT is
+   *        returned if the burst frame is not ready.
+   *
+   * @note Optional. Drivers that do not keep a separate queue per
+   *       configuration slot return RC_UNSUPPORTED.
+   * @note ReadBurst keeps returning the oldest burst of any slot and may be
+   *       mixed with per-slot reads; every burst is returned only once.
+   *       FIFO depth and the SetFifoMode overflow policy apply to the
+   *       whole FIFO shared by all slots, not to each slot separately.
+   */
+  virtual ReturnCode ReadSlotBurst(uint8_t /*slot_id*/,
+                                   BurstFormatExt& /*format*/,
+                                   std::vector<uint8_t>& /*raw_radar_data*/,
+                                   timespec /*deadline*/) {
+    return RC_UNSUPPORTED;
+  }
+
+  /*
+   * @brief Borrow the next burst directly from the driver's burst buffer
+   *        pool instead of copying it. The buffer is not reused by the
+   *        driver until it is returned with ReleaseBurst.
+   *
+   * @param burst where the borrowed burst will be written into.
+   * @param deadline the CLOCK_MONOTONIC time after which RC_TIMEOUT is
+   *        returned if the burst frame is not ready.
+   *
+   * @note Optional. Drivers without a shareable burst pool return
+   *       RC_UNSUPPORTED.
+   * @note A borrowed burst is removed from the FIFO and no longer counts
+   *       against its depth, so overflow policies never evict it. If
+   *       SetMaxBorrowedBursts bursts are already borrowed, RC_RES_LIMIT is
+   *       returned and the burst stays in the FIFO.
+   * @note A borrowed buffer stays valid until it is released, including
+   *       across StopDataStreaming, DeactivateConfig and Restart. A
+   *       shrinking SetMemoryBudget or SetFifoDepth never reclaims borrowed
+   *       buffers and returns RC_RES_LIMIT if it would need them. The
+   *       sensor must not be destroyed while any buffer is still borrowed.
+   */
+  virtual ReturnCode AcquireBurst(BorrowedBurst& /*burst*/,
+                                  timespec /*deadline*/) {
+    return RC_UNSUPPORTED;
+  }
+
+  /*
+   * @brief Borrow several bursts at once. Waits for the first burst like
+   *        AcquireBurst, then borrows up to max_bursts bursts that are
+   *        already in the FIFO without waiting for more.
+   *
+   * @param bursts where the borrowed bursts will be written into.
+   * @param max_bursts the maximum amount of bursts to borrow.
+   * @param deadline the CLOCK_MONOTONIC time after which RC_TIMEOUT is
+   *        returned if no burst frame is ready.
+   *
+   * @note Optional, same rules as for AcquireBurst apply to every burst.
+   *       Borrowing stops early when the SetMaxBorrowedBursts limit is
+   *       reached.
+   */
+  virtual ReturnCode AcquireBursts(std::vector<BorrowedBurst>& /*bursts*/,
+                                   uint32_t /*max_bursts*/,
+                                   timespec /*deadline*/) {
+    return RC_UNSUPPORTED;
+  }
+
+  /*
+   * @brief Return a burst borrowed with AcquireBurst(s) to the driver.
+   *
+   * @param token the token of the borrowed burst.
+   *
+   * @note RC_BAD_INPUT is returned if the token does not identify a current
+   *       borrow, including one that has already been released. A stale
+   *       token never releases a buffer lent out again later.
+   */
+  virtual ReturnCode ReleaseBurst(BurstToken /*token*/) {
+    return RC_UNSUPPORTED;
+  }
+
   // Miscellaneous.
 
   /*